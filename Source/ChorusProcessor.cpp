@@ -8,8 +8,11 @@
   ==============================================================================
 */
 #include "ChorusProcessor.h"
+#include "CompactSampleConversion.h"
 #include <cmath>
 
+using namespace CompactSampleConversion;
+
 // Linear interpolation (for reference)
 //DEPRECATED
 float ChorusProcessor::getInterpolatedSample(const float* buffer, int bufferSize, int index, float delayOffset)
@@ -50,25 +53,14 @@ float ChorusProcessor::getCubicInterpolatedSample(const float* buffer, int buffe
     return ((a0 * frac + a1) * frac + a2) * frac + a3;
 }
 
-float ChorusProcessor::getBandLimitedInterpolatedSample(const float* buffer, int bufferSize, float delayIndex)
+float ChorusProcessor::applyBandLimitedKernel(const float* samples, float frac)
 {
-    const int kernelRadius = 8; // Half-width of the interpolation kernel
     float result = 0.0f;
     float sum = 0.0f;
     
-    int baseIndex = static_cast<int>(std::floor(delayIndex));
-    float frac = delayIndex - baseIndex;
-    
     // Loop over the kernel window
     for (int i = -kernelRadius; i <= kernelRadius; i++)
     {
-        // Compute the sample index (wrap around if necessary)
-        int sampleIndex = baseIndex + i;
-        while (sampleIndex < 0)
-            sampleIndex += bufferSize;
-        while (sampleIndex >= bufferSize)
-            sampleIndex -= bufferSize;
-        
         // x is the distance from the actual delay position
         float x = static_cast<float>(i) - frac;
         
@@ -80,7 +72,7 @@ float ChorusProcessor::getBandLimitedInterpolatedSample(const float* buffer, int
         float window = 0.5f * (1.0f + std::cos((M_PI * x) / kernelRadius));
         
         float weight = sincValue * window;
-        result += buffer[sampleIndex] * weight;
+        result += samples[i + kernelRadius] * weight;
         sum += weight;
     }
     
@@ -88,6 +80,56 @@ float ChorusProcessor::getBandLimitedInterpolatedSample(const float* buffer, int
     return result / sum;
 }
 
+float ChorusProcessor::getBandLimitedInterpolatedSample(const float* buffer, int bufferSize, float delayIndex)
+{
+    int baseIndex = static_cast<int>(std::floor(delayIndex));
+    float frac = delayIndex - baseIndex;
+    
+    // First sample of the kernel window (wrap around if necessary)
+    int firstIndex = baseIndex - kernelRadius;
+    while (firstIndex < 0)
+        firstIndex += bufferSize;
+    while (firstIndex >= bufferSize)
+        firstIndex -= bufferSize;
+    
+    // Read straight from the delay buffer unless the window wraps.
+    if (firstIndex + kernelSize <= bufferSize)
+        return applyBandLimitedKernel(buffer + firstIndex, frac);
+    
+    std::array<float, kernelSize> window;
+    for (int i = 0; i < kernelSize; ++i)
+        window[static_cast<size_t>(i)] = buffer[(firstIndex + i) % bufferSize];
+    
+    return applyBandLimitedKernel(window.data(), frac);
+}
+
+float ChorusProcessor::getBandLimitedInterpolatedSample(const juce::int16* buffer, int bufferSize, float delayIndex)
+{
+    int baseIndex = static_cast<int>(std::floor(delayIndex));
+    float frac = delayIndex - baseIndex;
+    
+    int firstIndex = baseIndex - kernelRadius;
+    while (firstIndex < 0)
+        firstIndex += bufferSize;
+    while (firstIndex >= bufferSize)
+        firstIndex -= bufferSize;
+    
+    // Convert the kernel window to float, splitting it where it wraps.
+    std::array<float, kernelSize> window;
+    int firstPart = juce::jmin(kernelSize, bufferSize - firstIndex);
+    convertCompactToFloat(buffer + firstIndex, window.data(), firstPart);
+    
+    for (int i = firstPart; i < kernelSize; ++i)
+        window[static_cast<size_t>(i)] = static_cast<float>(buffer[(firstIndex + i) % bufferSize]) * compactToFloat;
+    
+    return applyBandLimitedKernel(window.data(), frac);
+}
+
+void ChorusProcessor::setCompactDelayStorage(bool shouldUseCompactStorage)
+{
+    compactStorageRequested = shouldUseCompactStorage;
+}
+
 
 void ChorusProcessor::prepare(const juce::dsp::ProcessSpec& spec)
 {
@@ -112,8 +154,12 @@ void ChorusProcessor::prepare(const juce::dsp::ProcessSpec& spec)
     maxDelaySamples = static_cast<int>((depth * 0.001f + 0.05f) * sampleRate);
     
     // Resize and initialize raw delay buffers and write positions.
+    // Only the storage in use is allocated.
+    useCompactStorage = compactStorageRequested;
     delayBuffers.clear();
     delayBuffers.resize(numChannels);
+    compactDelayBuffers.clear();
+    compactDelayBuffers.resize(numChannels);
     writePositions.clear();
     writePositions.resize(numChannels, 0);
     
@@ -128,9 +174,24 @@ void ChorusProcessor::prepare(const juce::dsp::ProcessSpec& spec)
     oversampler->reset();
     oversampler->initProcessing(static_cast<size_t>(spec.maximumBlockSize));
     
+    // --- Parameter Smoothing ---
+    const double rampLengthSeconds = 0.005;
+    smoothedDepth.reset(sampleRate * factor, rampLengthSeconds);
+    smoothedDepth.setCurrentAndTargetValue(depth);
+    smoothedMix.reset(sampleRate * factor, rampLengthSeconds);
+    smoothedMix.setCurrentAndTargetValue(mix);
+    
+    // Feed the modulation scope at roughly 200 values per second.
+    const int scopeValuesPerSecond = 200;
+    scopeDecimation = juce::jmax(1, static_cast<int>(sampleRate * factor) / scopeValuesPerSecond);
+    scopeDecimationCounter = 0;
+    
     for (int ch = 0; ch < numChannels; ++ch)
     {
-        delayBuffers[ch].assign(maxDelaySamples, 0.0f);
+        if (useCompactStorage)
+            compactDelayBuffers[ch].assign(maxDelaySamples, juce::int16 { 0 });
+        else
+            delayBuffers[ch].assign(maxDelaySamples, 0.0f);
     }
 }
 
@@ -146,7 +207,13 @@ void ChorusProcessor::process(juce::dsp::ProcessContextReplacing<float>& context
     {
         float* channelData = block.getChannelPointer(ch);
         auto& buffer = delayBuffers[ch];
+        auto& compactBuffer = compactDelayBuffers[ch];
         int& writePos = writePositions[ch];
+        
+        // Each channel walks its own copy of the ramps; the shared ones are
+        // advanced once after the loop.
+        auto depthRamp = smoothedDepth;
+        auto mixRamp = smoothedMix;
 
         for (int sample = 0; sample < numSamples; ++sample)
         {
@@ -154,22 +221,35 @@ void ChorusProcessor::process(juce::dsp::ProcessContextReplacing<float>& context
             smoothedLfoValue = lfoSmoothCoeff * rawLfo + (1.0f - lfoSmoothCoeff) * smoothedLfoValue;
 
             float modDepthFactor = 0.4f;
-            float baseDelaySamples = depth * sampleRateOS * 0.001f;
+            float currentDepth = depthRamp.getNextValue();
+            float currentMix = mixRamp.getNextValue();
+            float baseDelaySamples = currentDepth * sampleRateOS * 0.001f;
             float modulator = ((smoothedLfoValue * 0.5f) + 0.5f) * modDepthFactor;
             float delayTimeSamples = baseDelaySamples * modulator;
 
+            if (ch == 0 && ++scopeDecimationCounter >= scopeDecimation)
+            {
+                scopeDecimationCounter = 0;
+                modulationFifo.push(delayTimeSamples * 1000.0f / sampleRateOS);
+            }
+
             float readPos = static_cast<float>(writePos) - delayTimeSamples;
             if (readPos < 0)
                 readPos += maxDelaySamples;
 
-            float delayedSample = getBandLimitedInterpolatedSample(buffer.data(), maxDelaySamples, readPos);
+            float delayedSample = useCompactStorage
+                ? getBandLimitedInterpolatedSample(compactBuffer.data(), maxDelaySamples, readPos)
+                : getBandLimitedInterpolatedSample(buffer.data(), maxDelaySamples, readPos);
 
-            float dryMix = 1.0f - mix * 0.8f;
-            float wetMix = mix;
+            float dryMix = 1.0f - currentMix * 0.8f;
+            float wetMix = currentMix;
             float inputSample = channelData[sample];
             channelData[sample] = inputSample * dryMix + delayedSample * wetMix;
 
-            buffer[writePos] = inputSample;
+            if (useCompactStorage)
+                compactBuffer[writePos] = toCompactSample(inputSample);
+            else
+                buffer[writePos] = inputSample;
             writePos = (writePos + 1) % maxDelaySamples;
 
             lfoPhase += juce::MathConstants<float>::twoPi * rate / sampleRateOS;
@@ -178,6 +258,9 @@ void ChorusProcessor::process(juce::dsp::ProcessContextReplacing<float>& context
         }
     }
 
+    smoothedDepth.skip(numSamples);
+    smoothedMix.skip(numSamples);
+
     oversampler->processSamplesDown(context.getOutputBlock());
 }
 
@@ -189,10 +272,13 @@ void ChorusProcessor::reset()
 
     lowPassFilter.reset();
     lfo.reset();
+    smoothedDepth.setCurrentAndTargetValue(depth);
+    smoothedMix.setCurrentAndTargetValue(mix);
 
     for (int ch = 0; ch < numChannels; ++ch)
     {
         std::fill(delayBuffers[ch].begin(), delayBuffers[ch].end(), 0.0f);
+        std::fill(compactDelayBuffers[ch].begin(), compactDelayBuffers[ch].end(), 0);
         writePositions[ch] = 0;
     }
 }
@@ -215,10 +301,12 @@ void ChorusProcessor::setDepth(float newDepth)
 {
     // Optional clamp or scale
     depth = std::clamp(newDepth, 0.5f, 10.0f); // For example, 0.5ms to 10ms range
+    smoothedDepth.setTargetValue(depth);
 }
 
 
 void ChorusProcessor::setMix(float newMix)
 {
     mix = newMix;
+    smoothedMix.setTargetValue(mix);
 }
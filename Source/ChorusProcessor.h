@@ -10,7 +10,10 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include <array>
+#include <atomic>
 #include <vector>
+#include "ModulationFifo.h"
 
 class ChorusProcessor
 {
@@ -43,7 +46,26 @@ public:
     // Band-limited interpolation method
     float getBandLimitedInterpolatedSample(const float* buffer, int bufferSize, float delayIndex);
     
+    // Band-limited interpolation over compact (16-bit) delay history.
+    float getBandLimitedInterpolatedSample(const juce::int16* buffer, int bufferSize, float delayIndex);
+    
+    // Keep the delay history as scaled 16-bit samples, halving the delay
+    // buffer footprint at a noise floor of about -95 dBFS (±2.0 full scale).
+    // Takes effect on the next prepare().
+    void setCompactDelayStorage(bool shouldUseCompactStorage);
+    bool isUsingCompactDelayStorage() const { return useCompactStorage; }
+    
+    // Decimated delay-time trace (in ms) for the editor's modulation scope.
+    ModulationFifo& getModulationFifo() { return modulationFifo; }
+    
 private:
+    static constexpr int kernelRadius = 8; // Half-width of the interpolation kernel
+    static constexpr int kernelSize = 2 * kernelRadius + 1;
+    
+    // Windowed-sinc kernel over kernelSize contiguous samples centred on the
+    // integer part of the delay index.
+    static float applyBandLimitedKernel(const float* window, float frac);
+    
     // DSP variables.
     float sampleRate { 44100.0f };
     int numChannels { 2 };
@@ -52,6 +74,11 @@ private:
     float rate { 0.25f };    // LFO rate in Hz.
     float depth { 10.0f };   // Modulation depth in milliseconds.
     float mix { 0.5f };      // Wet/dry mix (0.0 to 1.0).
+    
+    // Per-sample ramps towards depth and mix, restarted at each change so
+    // in-block automation stays aligned with its change points.
+    juce::SmoothedValue<float> smoothedDepth { 10.0f };
+    juce::SmoothedValue<float> smoothedMix { 0.5f };
     float lfoPhase { 0.0f };  // LFO phase for chorus modulation.
     float smoothedLfoValue { 0.0f };
     float lfoSmoothingFactor { 0.05f }; // Controls the smoothness of LFO transitions.
@@ -61,10 +88,18 @@ private:
     // Raw circular delay buffers – one per channel.
     //i did not use JUCE's delayline because it does not expose methods to access pointes in the buffer
     std::vector<std::vector<float>> delayBuffers;
+    std::vector<std::vector<juce::int16>> compactDelayBuffers;
+    std::atomic<bool> compactStorageRequested { false };
+    bool useCompactStorage { false };
     std::vector<int> writePositions;
     int maxDelaySamples { 0 };
     
     std::unique_ptr<juce::dsp::Oversampling<float>> oversampler;
+    
+    // Modulation display feed, written from the audio thread only.
+    ModulationFifo modulationFifo;
+    int scopeDecimation { 1 };
+    int scopeDecimationCounter { 0 };
 
     // JUCE DSP oscillator as the LFO.
     juce::dsp::Oscillator<float> lfo;
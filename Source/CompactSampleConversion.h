@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+  
+    CompactSampleConversion.h
+    Created: 19 Oct 2026 3:12:08pm
+    Author:  Giuseppe Rivezzi
+  
+  ==============================================================================
+*/
+#pragma once
+
+#include <JuceHeader.h>
+
+// Compact delay storage: samples are kept as int16 scaled to ±compactFullScale,
+// leaving 6 dB of headroom over 0 dBFS before saturation.
+namespace CompactSampleConversion
+{
+    constexpr float compactFullScale = 2.0f;
+    constexpr float floatToCompact = 32767.0f / compactFullScale;
+    constexpr float compactToFloat = compactFullScale / 32767.0f;
+    
+    inline juce::int16 toCompactSample(float sample)
+    {
+        return static_cast<juce::int16>(juce::roundToInt(juce::jlimit(-32767.0f, 32767.0f, sample * floatToCompact)));
+    }
+    
+    // Reference conversion, one sample at a time.
+    inline void convertCompactToFloatScalar(const juce::int16* src, float* dest, int numSamples)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            dest[i] = static_cast<float>(src[i]) * compactToFloat;
+    }
+    
+    // Converts compact samples back to float, eight at a time where SIMD is available.
+    inline void convertCompactToFloat(const juce::int16* src, float* dest, int numSamples)
+    {
+        int i = 0;
+        
+       #if JUCE_USE_SSE_INTRINSICS
+        const __m128 scale = _mm_set1_ps(compactToFloat);
+        for (; i + 8 <= numSamples; i += 8)
+        {
+            __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            // Sign-extend each int16 into the upper half of an int32, then shift back down.
+            __m128i low  = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+            __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(packed, packed), 16);
+            _mm_storeu_ps(dest + i,     _mm_mul_ps(_mm_cvtepi32_ps(low), scale));
+            _mm_storeu_ps(dest + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), scale));
+        }
+       #elif JUCE_USE_ARM_NEON
+        const float32x4_t scale = vdupq_n_f32(compactToFloat);
+        for (; i + 8 <= numSamples; i += 8)
+        {
+            int16x8_t packed = vld1q_s16(src + i);
+            vst1q_f32(dest + i,     vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(packed))), scale));
+            vst1q_f32(dest + i + 4, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(packed))), scale));
+        }
+       #endif
+        
+        convertCompactToFloatScalar(src + i, dest + i, numSamples - i);
+    }
+}
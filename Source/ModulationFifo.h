@@ -0,0 +1,45 @@
+/*
+  ==============================================================================
+  
+    ModulationFifo.h
+    Created: 18 Oct 2026 10:12:04am
+    Author:  Giuseppe Rivezzi
+  
+  ==============================================================================
+*/
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+
+// Single-producer / single-consumer FIFO that hands modulation values from the
+// audio thread to the editor without taking any lock.
+class ModulationFifo
+{
+public:
+    static constexpr int capacity = 1024;
+
+    // Audio thread only. The value is dropped if the reader has fallen behind.
+    void push(float value) noexcept
+    {
+        const auto scope = fifo.write(1);
+        
+        if (scope.blockSize1 > 0)
+            buffer[static_cast<size_t>(scope.startIndex1)] = value;
+    }
+    
+    // Message thread only. Returns the number of values copied into dest.
+    int pop(float* dest, int maxValues) noexcept
+    {
+        const auto scope = fifo.read(juce::jmin(maxValues, fifo.getNumReady()));
+        
+        std::copy_n(buffer.begin() + scope.startIndex1, scope.blockSize1, dest);
+        std::copy_n(buffer.begin() + scope.startIndex2, scope.blockSize2, dest + scope.blockSize1);
+        
+        return scope.blockSize1 + scope.blockSize2;
+    }
+    
+private:
+    juce::AbstractFifo fifo { capacity };
+    std::array<float, capacity> buffer {};
+};
@@ -0,0 +1,93 @@
+/*
+  ==============================================================================
+  
+    ModulationScope.cpp
+    Created: 18 Oct 2026 10:14:51am
+    Author:  Giuseppe Rivezzi
+  
+  ==============================================================================
+*/
+#include "ModulationScope.h"
+
+ModulationScope::ModulationScope(ModulationFifo& fifoToRead)
+    : fifo(fifoToRead)
+{
+    // The scope fills its own bounds, so the editor background behind it
+    // never needs repainting when the trace moves.
+    setOpaque(true);
+    startTimerHz(refreshRateHz);
+}
+
+ModulationScope::~ModulationScope()
+{
+    stopTimer();
+}
+
+void ModulationScope::timerCallback()
+{
+    const int numRead = fifo.pop(incoming.data(), static_cast<int>(incoming.size()));
+    
+    if (numRead == 0)
+        return;
+    
+    for (int i = 0; i < numRead; ++i)
+    {
+        history[static_cast<size_t>(historyStart)] = incoming[static_cast<size_t>(i)];
+        historyStart = (historyStart + 1) % historySize;
+    }
+    
+    // Only the scope's own area is invalidated.
+    repaint();
+}
+
+void ModulationScope::paint(juce::Graphics& g)
+{
+   #if ICHORUS_PROFILE_EDITOR
+    paintCounter.start();
+   #endif
+    
+    drawTrace(g);
+    
+   #if ICHORUS_PROFILE_EDITOR
+    paintCounter.stop();
+   #endif
+}
+
+void ModulationScope::drawTrace(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds().toFloat();
+    
+    g.fillAll(juce::Colours::darkslategrey);
+    g.setColour(juce::Colours::lightblue.withAlpha(0.3f));
+    g.drawRect(bounds, 1.0f);
+    
+    // Auto-scale to the largest delay time currently on screen.
+    float peak = 0.0f;
+    for (auto value : history)
+        peak = juce::jmax(peak, value);
+    
+    if (peak <= 0.0f)
+        return;
+    
+    auto plotArea = bounds.reduced(4.0f);
+    const float xStep = plotArea.getWidth() / static_cast<float>(historySize - 1);
+    
+    juce::Path trace;
+    for (int i = 0; i < historySize; ++i)
+    {
+        float value = history[static_cast<size_t>((historyStart + i) % historySize)];
+        float x = plotArea.getX() + xStep * static_cast<float>(i);
+        float y = plotArea.getBottom() - plotArea.getHeight() * (value / peak);
+        
+        if (i == 0)
+            trace.startNewSubPath(x, y);
+        else
+            trace.lineTo(x, y);
+    }
+    
+    g.setColour(juce::Colours::lightblue);
+    g.strokePath(trace, juce::PathStrokeType(1.5f));
+    
+    g.setFont(juce::FontOptions(12.0f));
+    g.drawText(juce::String(peak, 2) + " ms", bounds.reduced(6.0f), juce::Justification::topRight);
+}
@@ -0,0 +1,54 @@
+/*
+  ==============================================================================
+  
+    ModulationScope.h
+    Created: 18 Oct 2026 10:14:51am
+    Author:  Giuseppe Rivezzi
+  
+  ==============================================================================
+*/
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+#include "ModulationFifo.h"
+
+// Set ICHORUS_PROFILE_EDITOR=1 in the exporter's preprocessor definitions to
+// log average paint times of the editor and the scope (juce::PerformanceCounter).
+#ifndef ICHORUS_PROFILE_EDITOR
+ #define ICHORUS_PROFILE_EDITOR 0
+#endif
+
+// Live view of the modulated delay time, fed by the audio thread through a
+// ModulationFifo and repainted from a capped-rate timer.
+class ModulationScope : public juce::Component,
+                        private juce::Timer
+{
+public:
+    explicit ModulationScope(ModulationFifo& fifoToRead);
+    ~ModulationScope() override;
+    
+    void paint(juce::Graphics&) override;
+    
+private:
+    void timerCallback() override;
+    void drawTrace(juce::Graphics&);
+    
+    static constexpr int refreshRateHz = 30;
+    static constexpr int historySize = 256;
+    
+    ModulationFifo& fifo;
+    
+    // Circular history of the last delay times (in ms), oldest at historyStart.
+    std::array<float, historySize> history {};
+    int historyStart { 0 };
+    
+    // Scratch space for draining the FIFO without allocating.
+    std::array<float, ModulationFifo::capacity> incoming {};
+    
+   #if ICHORUS_PROFILE_EDITOR
+    juce::PerformanceCounter paintCounter { "ModulationScope::paint", 100 };
+   #endif
+    
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ModulationScope)
+};
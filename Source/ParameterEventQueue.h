@@ -0,0 +1,85 @@
+/*
+  ==============================================================================
+  
+    ParameterEventQueue.h
+    Created: 18 Oct 2026 4:41:18pm
+    Author:  Giuseppe Rivezzi
+  
+  ==============================================================================
+*/
+#pragma once
+
+#include <JuceHeader.h>
+#include <array>
+
+// A parameter change that lands sampleOffset samples into the next block.
+struct ParameterEvent
+{
+    int parameterIndex { -1 };   // Index in AudioProcessor::getParameters().
+    int sampleOffset { 0 };
+    float value { 0.0f };        // Normalised, 0.0 to 1.0.
+};
+
+// Timestamped parameter changes for the next processBlock. Events are added
+// on the thread that calls processBlock, just before the call, so a plain
+// array is enough; processBlock consumes and clears it.
+class ParameterEventQueue
+{
+public:
+    static constexpr int capacity = 512;
+    
+    // Returns false if the queue is full and the event was dropped.
+    bool add(const ParameterEvent& event) noexcept
+    {
+        if (numEvents == capacity)
+            return false;
+        
+        events[static_cast<size_t>(numEvents++)] = event;
+        return true;
+    }
+    
+    ParameterEvent* data() noexcept { return events.data(); }
+    int size() const noexcept { return numEvents; }
+    void clear() noexcept { numEvents = 0; }
+    
+private:
+    std::array<ParameterEvent, capacity> events {};
+    int numEvents { 0 };
+};
+
+// Sorts events by offset in place (insertion sort: stable, no allocation,
+// linear when already sorted), then walks a block of numSamples: calls
+// processRange(startSample, numSamplesInRange) for each span between change
+// points and applyEvent(event) at each change point. Offsets outside the
+// block are clamped to its start or end.
+template <typename ProcessRange, typename ApplyEvent>
+void processWithParameterEvents(ParameterEvent* events, int numEvents, int numSamples,
+                                ProcessRange&& processRange, ApplyEvent&& applyEvent)
+{
+    for (int i = 1; i < numEvents; ++i)
+    {
+        const auto event = events[i];
+        int j = i;
+        
+        for (; j > 0 && events[j - 1].sampleOffset > event.sampleOffset; --j)
+            events[j] = events[j - 1];
+        
+        events[j] = event;
+    }
+    
+    int position = 0;
+    
+    for (int i = 0; i <= numEvents; ++i)
+    {
+        const int end = i < numEvents ? juce::jlimit(0, numSamples, events[i].sampleOffset) : numSamples;
+        
+        if (end > position)
+        {
+            processRange(position, end - position);
+            position = end;
+        }
+        
+        if (i < numEvents)
+            applyEvent(events[i]);
+    }
+}
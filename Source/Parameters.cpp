@@ -42,6 +42,15 @@ juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout()
         0.5f
     ));
 
+    // Define the 'compactDelay' option: keeps the delay history in 16-bit form.
+    // Not automatable, since it only takes effect on the next prepareToPlay.
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID { "compactDelay", 1 },
+        "16-bit Delay",
+        false,
+        juce::AudioParameterBoolAttributes().withAutomatable(false)
+    ));
+
     // Return the ParameterLayout constructed from the vector of parameters.
     return { params.begin(), params.end() };
 }
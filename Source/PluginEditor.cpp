@@ -32,8 +32,12 @@ void IChorusAudioProcessorEditor::configureSlider(juce::Slider& slider, const ju
 
 //==============================================================================
 IChorusAudioProcessorEditor::IChorusAudioProcessorEditor (IChorusAudioProcessor& p)
-    : AudioProcessorEditor (&p), audioProcessor (p)
+    : AudioProcessorEditor (&p), audioProcessor (p),
+      modulationScope (p.getModulationFifo())
 {
+    // The cached background covers every pixel.
+    setOpaque(true);
+    
     // Set the size of the editor (increased for a more spacious layout).
     setSize (500, 400);
     
@@ -49,6 +53,12 @@ IChorusAudioProcessorEditor::IChorusAudioProcessorEditor (IChorusAudioProcessor&
     configureSlider(depthSlider, "Depth");
     configureSlider(mixSlider, "Mix");
     
+    addAndMakeVisible(modulationScope);
+    
+    compactDelayButton.setButtonText("16-bit delay (takes effect when the plugin is re-initialised)");
+    compactDelayButton.setColour(juce::ToggleButton::textColourId, juce::Colours::darkslategrey);
+    addAndMakeVisible(compactDelayButton);
+    
     // Attach sliders to the corresponding parameters in the APVTS.
     rateAttachment  = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
                           audioProcessor.getAPVTS(), "rate", rateSlider);
@@ -56,6 +66,8 @@ IChorusAudioProcessorEditor::IChorusAudioProcessorEditor (IChorusAudioProcessor&
                           audioProcessor.getAPVTS(), "depth", depthSlider);
     mixAttachment   = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
                           audioProcessor.getAPVTS(), "mix", mixSlider);
+    compactDelayAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+                          audioProcessor.getAPVTS(), "compactDelay", compactDelayButton);
 }
 
 IChorusAudioProcessorEditor::~IChorusAudioProcessorEditor()
@@ -65,16 +77,53 @@ IChorusAudioProcessorEditor::~IChorusAudioProcessorEditor()
 //==============================================================================
 void IChorusAudioProcessorEditor::paint (juce::Graphics& g)
 {
-    // Draw a professional gradient background.
+   #if ICHORUS_PROFILE_EDITOR
+    paintCounter.start();
+   #endif
+    
+    if (backgroundImage.isNull())
+        renderBackground();
+    
+    g.drawImage(backgroundImage, getLocalBounds().toFloat());
+    
+   #if ICHORUS_PROFILE_EDITOR
+    paintCounter.stop();
+   #endif
+}
+
+// Draws the gradient background into backgroundImage at the display scale.
+void IChorusAudioProcessorEditor::renderBackground()
+{
     auto bounds = getLocalBounds();
+    
+    if (bounds.isEmpty())
+        return;
+    
+    const float scale = juce::Component::getApproximateScaleFactorForComponent(this);
+    backgroundImage = juce::Image(juce::Image::RGB,
+                                  juce::roundToInt(bounds.getWidth() * scale),
+                                  juce::roundToInt(bounds.getHeight() * scale),
+                                  false);
+    
+    // Draw a professional gradient background.
+    juce::Graphics g (backgroundImage);
+    g.addTransform(juce::AffineTransform::scale(scale));
     juce::ColourGradient gradient (juce::Colours::white, 0, 0,
                                    juce::Colours::grey, 0, static_cast<float>(bounds.getHeight()), true);
     g.setGradientFill(gradient);
     g.fillAll();
 }
 
+void IChorusAudioProcessorEditor::invalidateBackground()
+{
+    backgroundImage = {};
+}
+
 void IChorusAudioProcessorEditor::resized()
 {
+    // Only a resize invalidates the cached background.
+    invalidateBackground();
+    
     auto area = getLocalBounds().reduced(10);
     
     // Position the title at the top.
@@ -87,4 +136,10 @@ void IChorusAudioProcessorEditor::resized()
     rateSlider.setBounds(slidersArea.removeFromLeft(sliderWidth).reduced(10));
     depthSlider.setBounds(slidersArea.removeFromLeft(sliderWidth).reduced(10));
     mixSlider.setBounds(slidersArea.reduced(10));
+    
+    // The storage option sits along the bottom edge.
+    compactDelayButton.setBounds(area.removeFromBottom(24).reduced(10, 0));
+    
+    // The modulation scope takes the rest of the lower half, leaving room for the slider labels.
+    modulationScope.setBounds(area.withTrimmedTop(20).reduced(10));
 }; 
\ No newline at end of file
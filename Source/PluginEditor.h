@@ -14,6 +14,7 @@
 
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
+#include "ModulationScope.h"
 
 //==============================================================================
 class IChorusAudioProcessorEditor  : public juce::AudioProcessorEditor
@@ -25,8 +26,12 @@ public:
     void paint (juce::Graphics&) override;
     void resized() override;
 
+    // Drops the cached background so the next paint re-renders it.
+    void invalidateBackground();
+
 private:
     void configureSlider(juce::Slider& slider, const juce::String& labelText);
+    void renderBackground();
 
     IChorusAudioProcessor& audioProcessor;
 
@@ -36,11 +41,23 @@ private:
     juce::Slider rateSlider;
     juce::Slider depthSlider;
     juce::Slider mixSlider;
+    juce::ToggleButton compactDelayButton;
+
+    // Live LFO / delay-time display
+    ModulationScope modulationScope;
+
+    // Static gradient, rendered once per size instead of on every repaint
+    juce::Image backgroundImage;
+
+   #if ICHORUS_PROFILE_EDITOR
+    juce::PerformanceCounter paintCounter { "IChorusAudioProcessorEditor::paint", 100 };
+   #endif
 
     // Attachments for APVTS
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> rateAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> depthAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> mixAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> compactDelayAttachment;
 
     // Keep track of labels for memory management
     juce::OwnedArray<juce::Label> sliderLabels;
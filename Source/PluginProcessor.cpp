@@ -21,6 +21,10 @@ IChorusAudioProcessor::IChorusAudioProcessor()
     ),
     apvts(*this, nullptr, "PARAMETERS", createParameterLayout())  // Initialize APVTS with parameters
 {
+    // Cached so timestamped events can be mapped without lookups on the audio thread
+    rateParameter  = apvts.getParameter("rate");
+    depthParameter = apvts.getParameter("depth");
+    mixParameter   = apvts.getParameter("mix");
 }
 
 IChorusAudioProcessor::~IChorusAudioProcessor()
@@ -99,9 +103,16 @@ void IChorusAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     spec.maximumBlockSize = samplesPerBlock;
     spec.numChannels = getTotalNumOutputChannels();
     
+    chorusProcessor.setCompactDelayStorage(*apvts.getRawParameterValue("compactDelay") > 0.5f);
     chorusProcessor.prepare(spec);
 }
 
+void IChorusAudioProcessor::setCompactDelayStorage(bool shouldUseCompactStorage)
+{
+    if (auto* param = apvts.getParameter("compactDelay"))
+        param->setValueNotifyingHost(shouldUseCompactStorage ? 1.0f : 0.0f);
+}
+
 void IChorusAudioProcessor::releaseResources()
 {
     // When playback stops, you can use this as an opportunity to free up any
@@ -144,13 +155,64 @@ void IChorusAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
 
-    // Update parameters before processing
-    chorusProcessor.updateParameters(apvts);
+    // Timestamped changes for this block
+    auto* blockEvents = parameterEvents.data();
+    const int numEvents = parameterEvents.size();
 
-    // Prepare the processing context and apply the effect
+    auto hasEvents = [blockEvents, numEvents](const juce::RangedAudioParameter* param)
+    {
+        return std::any_of(blockEvents, blockEvents + numEvents,
+                           [param](const ParameterEvent& e) { return e.parameterIndex == param->getParameterIndex(); });
+    };
+
+    // Update parameters before processing. Parameters with events this block
+    // keep their current value until their first change point, since the
+    // APVTS already holds their end-of-block value.
+    if (numEvents == 0)
+    {
+        chorusProcessor.updateParameters(apvts);
+    }
+    else
+    {
+        if (! hasEvents(rateParameter))
+            chorusProcessor.setRate(rateParameter->convertFrom0to1(rateParameter->getValue()));
+        if (! hasEvents(depthParameter))
+            chorusProcessor.setDepth(depthParameter->convertFrom0to1(depthParameter->getValue()));
+        if (! hasEvents(mixParameter))
+            chorusProcessor.setMix(mixParameter->convertFrom0to1(mixParameter->getValue()));
+    }
+
+    // Prepare the processing context and apply the effect, split at each
+    // change point so callers can keep large blocks without losing automation
     juce::dsp::AudioBlock<float> block(buffer);
-    juce::dsp::ProcessContextReplacing<float> context(block);
-    chorusProcessor.process(context);
+
+    processWithParameterEvents(blockEvents, numEvents, buffer.getNumSamples(),
+        [this, &block](int startSample, int numSamples)
+        {
+            auto subBlock = block.getSubBlock(static_cast<size_t>(startSample), static_cast<size_t>(numSamples));
+            juce::dsp::ProcessContextReplacing<float> context(subBlock);
+            chorusProcessor.process(context);
+        },
+        [this](const ParameterEvent& event) { applyParameterEvent(event); });
+
+    parameterEvents.clear();
+}
+
+bool IChorusAudioProcessor::queueParameterEvent(int parameterIndex, int sampleOffset, float normalisedValue)
+{
+    return parameterEvents.add({ parameterIndex, sampleOffset, normalisedValue });
+}
+
+void IChorusAudioProcessor::applyParameterEvent(const ParameterEvent& event)
+{
+    const float value = juce::jlimit(0.0f, 1.0f, event.value);
+
+    if (event.parameterIndex == rateParameter->getParameterIndex())
+        chorusProcessor.setRate(rateParameter->convertFrom0to1(value));
+    else if (event.parameterIndex == depthParameter->getParameterIndex())
+        chorusProcessor.setDepth(depthParameter->convertFrom0to1(value));
+    else if (event.parameterIndex == mixParameter->getParameterIndex())
+        chorusProcessor.setMix(mixParameter->convertFrom0to1(value));
 }
 
 //==============================================================================
@@ -165,15 +227,102 @@ juce::AudioProcessorEditor* IChorusAudioProcessor::createEditor()
 }
 
 //==============================================================================
+// Compact binary state layout (little endian):
+//   uint32 magic, uint16 version, uint16 parameter count,
+//   then per parameter a uint32 hash of its ID and a float holding its
+//   normalised value.
+// Values are matched to parameters by ID hash on load, so adding, removing or
+// reordering parameters never moves a value onto the wrong parameter.
+// Truncated blobs are rejected.
+// Blobs without the magic are treated as the older APVTS XML state.
+namespace
+{
+    constexpr int stateMagic = 0x53484349; // "ICHS"
+    constexpr int stateVersion = 1;
+    constexpr int stateHeaderSize = 8;
+
+    // FNV-1a over the UTF-8 ID, defined here so saved sessions do not
+    // depend on juce::String::hashCode staying the same.
+    juce::uint32 hashParameterID(const juce::String& parameterID)
+    {
+        juce::uint32 hash = 2166136261u;
+
+        for (auto* c = parameterID.toRawUTF8(); *c != 0; ++c)
+        {
+            hash ^= static_cast<juce::uint8>(*c);
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+}
+
 void IChorusAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-    auto state = apvts.copyState();
-    std::unique_ptr<juce::XmlElement> xml (state.createXml());
-    copyXmlToBinary (*xml, destData);
+    const auto& params = getParameters();
+    
+    destData.setSize(stateHeaderSize + params.size() * (sizeof(juce::uint32) + sizeof(float)));
+    juce::MemoryOutputStream stream (destData, false);
+    
+    stream.writeInt(stateMagic);
+    stream.writeShort(static_cast<short>(stateVersion));
+    stream.writeShort(static_cast<short>(params.size()));
+    
+    for (auto* param : params)
+    {
+        auto* withID = dynamic_cast<juce::AudioProcessorParameterWithID*>(param);
+        jassert(withID != nullptr); // every parameter comes from the APVTS layout
+        
+        stream.writeInt(static_cast<int>(withID != nullptr ? hashParameterID(withID->paramID) : 0u));
+        stream.writeFloat(param->getValue());
+    }
 }
 
 void IChorusAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
+    if (sizeInBytes >= stateHeaderSize
+         && juce::ByteOrder::littleEndianInt(data) == static_cast<juce::uint32>(stateMagic))
+    {
+        juce::MemoryInputStream stream (data, static_cast<size_t>(sizeInBytes), false);
+        stream.readInt();
+        
+        const int version = static_cast<juce::uint16>(stream.readShort());
+        const int numStored = static_cast<juce::uint16>(stream.readShort());
+        const auto& params = getParameters();
+        
+        // Blobs from a newer format, or truncated ones, are ignored rather than misread.
+        const auto pairSize = static_cast<juce::int64>(sizeof(juce::uint32) + sizeof(float));
+        if (version != stateVersion || stream.getNumBytesRemaining() < numStored * pairSize)
+            return;
+        
+        // Parameters missing from the blob go back to their defaults.
+        std::vector<float> values;
+        std::vector<juce::uint32> hashes;
+        for (auto* param : params)
+        {
+            auto* withID = dynamic_cast<juce::AudioProcessorParameterWithID*>(param);
+            hashes.push_back(withID != nullptr ? hashParameterID(withID->paramID) : 0u);
+            values.push_back(param->getDefaultValue());
+        }
+        
+        for (int i = 0; i < numStored; ++i)
+        {
+            const auto hash = static_cast<juce::uint32>(stream.readInt());
+            const float value = stream.readFloat();
+            
+            // Unknown IDs belong to parameters that no longer exist.
+            auto match = std::find(hashes.begin(), hashes.end(), hash);
+            if (match != hashes.end())
+                values[static_cast<size_t>(std::distance(hashes.begin(), match))] = juce::jlimit(0.0f, 1.0f, value);
+        }
+        
+        for (int i = 0; i < params.size(); ++i)
+            params[i]->setValueNotifyingHost(values[static_cast<size_t>(i)]);
+        
+        return;
+    }
+    
+    // Older sessions: XML state produced by copyXmlToBinary.
     std::unique_ptr<juce::XmlElement> xml (getXmlFromBinary (data, sizeInBytes));
     
     if (xml && xml->hasTagName(apvts.state.getType()))
@@ -11,6 +11,7 @@
 #include <JuceHeader.h>
 #include "ChorusProcessor.h"
 #include "Parameters.h"
+#include "ParameterEventQueue.h"
 
 //==============================================================================
 /**
@@ -57,10 +58,41 @@ public:
 
     // Access APVTS for UI binding
     juce::AudioProcessorValueTreeState& getAPVTS() { return apvts; }
+    
+    // Access the lock-free modulation feed for the editor's scope
+    ModulationFifo& getModulationFifo() { return chorusProcessor.getModulationFifo(); }
+    
+    // Per-instance 16-bit delay history ("compactDelay" parameter, saved with
+    // the state); applied on the next prepareToPlay
+    void setCompactDelayStorage(bool shouldUseCompactStorage);
+    bool isUsingCompactDelayStorage() const { return chorusProcessor.isUsingCompactDelayStorage(); }
+    
+    // Offline / embedding API: queue a sample-accurate parameter change for
+    // the next processBlock. Plugin hosts cannot reach this, since JUCE's
+    // wrappers do not forward per-sample automation points; it is for code
+    // that drives the processor directly (offline renders, tests, a custom
+    // wrapper).
+    //
+    // Call it on the thread that calls processBlock, just before that call;
+    // sampleOffset is relative to that block. Like a plugin wrapper, the
+    // caller is also responsible for the end-of-block value: set each
+    // automated parameter to its last event value before processBlock.
+    // processBlock never writes event values back to the parameters.
+    // Returns false if the queue is full.
+    bool queueParameterEvent(int parameterIndex, int sampleOffset, float normalisedValue);
 
 private:
+    void applyParameterEvent(const ParameterEvent& event);
+
     ChorusProcessor chorusProcessor;
     juce::AudioProcessorValueTreeState apvts;
+    
+    juce::RangedAudioParameter* rateParameter { nullptr };
+    juce::RangedAudioParameter* depthParameter { nullptr };
+    juce::RangedAudioParameter* mixParameter { nullptr };
+    
+    // Timestamped automation for the next block, sorted and consumed by processBlock.
+    ParameterEventQueue parameterEvents;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (IChorusAudioProcessor)
 };
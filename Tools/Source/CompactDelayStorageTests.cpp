@@ -0,0 +1,144 @@
+/*
+  ==============================================================================
+  
+    CompactDelayStorageTests.cpp
+    Created: 19 Oct 2026 3:40:52pm
+    Author:  Giuseppe Rivezzi
+  
+  ==============================================================================
+*/
+#include <JuceHeader.h>
+#include <vector>
+#include "../../Source/CompactSampleConversion.h"
+#include "../../Source/PluginProcessor.h"
+
+using namespace CompactSampleConversion;
+
+class CompactDelayStorageTests : public juce::UnitTest
+{
+public:
+    CompactDelayStorageTests() : juce::UnitTest("Compact delay storage", "IChorus") {}
+    
+    void runTest() override
+    {
+        auto random = getRandom();
+        
+        beginTest("SIMD conversion matches the scalar reference");
+        {
+            // Lengths around the 8-sample SIMD width, including the 17-tap kernel window.
+            for (int numSamples = 0; numSamples <= 40; ++numSamples)
+            {
+                std::vector<juce::int16> compact (static_cast<size_t>(numSamples));
+                for (auto& sample : compact)
+                    sample = static_cast<juce::int16>(random.nextInt({ -32767, 32768 }));
+                
+                std::vector<float> simd (compact.size()), scalar (compact.size());
+                convertCompactToFloat(compact.data(), simd.data(), numSamples);
+                convertCompactToFloatScalar(compact.data(), scalar.data(), numSamples);
+                
+                for (size_t i = 0; i < compact.size(); ++i)
+                    expectEquals(simd[i], scalar[i]);
+            }
+        }
+        
+        beginTest("Quantisation noise floor");
+        {
+            // Sine at -6 dBFS plus noise at -12 dBFS, written and read back once.
+            const int numSamples = 1 << 18;
+            double errorPower = 0.0, signalPower = 0.0;
+            
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const float input = 0.5f * std::sin(0.01f * static_cast<float>(i))
+                                    + 0.25f * (random.nextFloat() * 2.0f - 1.0f);
+                const juce::int16 compact = toCompactSample(input);
+                
+                float output = 0.0f;
+                convertCompactToFloat(&compact, &output, 1);
+                
+                errorPower += static_cast<double>((output - input) * (output - input));
+                signalPower += static_cast<double>(input * input);
+            }
+            
+            const double noiseFloorDb = 10.0 * std::log10(errorPower / numSamples);
+            const double snrDb = 10.0 * std::log10(signalPower / errorPower);
+            logMessage("Noise floor " + juce::String(noiseFloorDb, 1) + " dBFS, SNR " + juce::String(snrDb, 1) + " dB");
+            
+            // 16 bits over ±2.0 gives q / sqrt(12) ≈ -95 dBFS.
+            expectLessThan(noiseFloorDb, -94.0);
+        }
+        
+        beginTest("Out-of-range samples saturate");
+        {
+            expectEquals(static_cast<int>(toCompactSample(5.0f)), 32767);
+            expectEquals(static_cast<int>(toCompactSample(-5.0f)), -32767);
+        }
+        
+        beginTest("Compact output stays within the noise floor of float output");
+        {
+            // The compact instance gets its option through a state round trip.
+            IChorusAudioProcessor source;
+            source.setCompactDelayStorage(true);
+            
+            juce::MemoryBlock state;
+            source.getStateInformation(state);
+            
+            IChorusAudioProcessor floatStorage, compactStorage;
+            compactStorage.setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+            
+            const int blockSize = 512;
+            for (auto* processor : { &floatStorage, &compactStorage })
+            {
+                // Fully wet, so the delayed (quantised) signal dominates the output.
+                processor->getAPVTS().getParameter("mix")->setValueNotifyingHost(1.0f);
+                processor->prepareToPlay(48000.0, blockSize);
+            }
+            
+            expect(! floatStorage.isUsingCompactDelayStorage());
+            expect(compactStorage.isUsingCompactDelayStorage());
+            
+            const int numChannels = floatStorage.getTotalNumOutputChannels();
+            juce::AudioBuffer<float> floatBuffer (numChannels, blockSize), compactBuffer (numChannels, blockSize);
+            juce::MidiBuffer midi;
+            double differencePower = 0.0;
+            int numCompared = 0;
+            
+            for (int block = 0; block < 40; ++block)
+            {
+                // 440 Hz sine at -6 dBFS.
+                for (int ch = 0; ch < numChannels; ++ch)
+                    for (int i = 0; i < blockSize; ++i)
+                        floatBuffer.setSample(ch, i, 0.5f * std::sin(juce::MathConstants<float>::twoPi * 440.0f
+                                                                     * static_cast<float>(block * blockSize + i) / 48000.0f));
+                compactBuffer.makeCopyOf(floatBuffer, true);
+                
+                floatStorage.processBlock(floatBuffer, midi);
+                compactStorage.processBlock(compactBuffer, midi);
+                
+                // Skip the blocks where the delay line is still filling.
+                if (block < 10)
+                    continue;
+                
+                for (int ch = 0; ch < numChannels; ++ch)
+                {
+                    for (int i = 0; i < blockSize; ++i)
+                    {
+                        const double difference = compactBuffer.getSample(ch, i) - floatBuffer.getSample(ch, i);
+                        differencePower += difference * difference;
+                        ++numCompared;
+                    }
+                }
+            }
+            
+            const double differenceDb = 10.0 * std::log10(differencePower / numCompared + 1.0e-30);
+            logMessage("Compact vs float output difference " + juce::String(differenceDb, 1) + " dBFS");
+            
+            // Non-zero (the compact path really ran) but no louder than the
+            // documented ~-95 dBFS quantisation floor, with a little margin.
+            expectGreaterThan(differenceDb, -160.0);
+            expectLessThan(differenceDb, -90.0);
+        }
+    }
+};
+
+static CompactDelayStorageTests compactDelayStorageTests;
@@ -0,0 +1,66 @@
+/*
+  ==============================================================================
+  
+    EditorPaintBenchmark.cpp
+    Created: 19 Oct 2026 11:02:45am
+    Author:  Giuseppe Rivezzi
+  
+  ==============================================================================
+*/
+#include "EditorPaintBenchmark.h"
+#include "../../Source/PluginEditor.h"
+
+EditorPaintBenchmark::Result EditorPaintBenchmark::run(int numPaints)
+{
+    Result result;
+    numPaints = juce::jmax(1, numPaints);
+    
+    IChorusAudioProcessor processor;
+    std::unique_ptr<juce::AudioProcessorEditor> editor (processor.createEditor());
+    
+    juce::Image target (juce::Image::ARGB, editor->getWidth(), editor->getHeight(), true);
+    juce::Graphics g (target);
+    
+    // Average time of one call to paintOnce, in milliseconds.
+    auto timePaints = [numPaints](auto&& paintOnce)
+    {
+        paintOnce(); // warm-up
+        
+        const auto start = juce::Time::getHighResolutionTicks();
+        for (int i = 0; i < numPaints; ++i)
+            paintOnce();
+        
+        return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start)
+                 * 1000.0 / numPaints;
+    };
+    
+    result.cachedMs = timePaints([&] { editor->paintEntireComponent(g, true); });
+    
+    // Dropping only the cached background makes every paint re-render the
+    // gradient, with no re-layout, so the gradient is the only difference.
+    auto* chorusEditor = dynamic_cast<IChorusAudioProcessorEditor*>(editor.get());
+    jassert(chorusEditor != nullptr);
+    result.uncachedMs = timePaints([&] { chorusEditor->invalidateBackground(); editor->paintEntireComponent(g, true); });
+    
+    for (auto* child : editor->getChildren())
+    {
+        if (auto* scope = dynamic_cast<ModulationScope*>(child))
+        {
+            juce::Image scopeTarget (juce::Image::ARGB, scope->getWidth(), scope->getHeight(), true);
+            juce::Graphics scopeGraphics (scopeTarget);
+            result.scopeOnlyMs = timePaints([&] { scope->paintEntireComponent(scopeGraphics, true); });
+        }
+    }
+    
+    return result;
+}
+
+juce::String EditorPaintBenchmark::formatResult(const Result& result, int numPaints)
+{
+    juce::String text;
+    text << "IChorus editor paint, average of " << numPaints << " off-screen paints" << juce::newLine
+         << "  full repaint, cached background:   " << juce::String(result.cachedMs, 4) << " ms" << juce::newLine
+         << "  full repaint, gradient every time: " << juce::String(result.uncachedMs, 4) << " ms" << juce::newLine
+         << "  scope-only repaint:                " << juce::String(result.scopeOnlyMs, 4) << " ms" << juce::newLine;
+    return text;
+}
@@ -0,0 +1,29 @@
+/*
+  ==============================================================================
+  
+    EditorPaintBenchmark.h
+    Created: 19 Oct 2026 11:02:45am
+    Author:  Giuseppe Rivezzi
+  
+  ==============================================================================
+*/
+#pragma once
+
+#include <JuceHeader.h>
+
+// Times editor repaints off-screen: a full repaint with the cached
+// background, a full repaint with the cache invalidated every time (what
+// the editor did before the cache existed), and a scope-only repaint.
+class EditorPaintBenchmark
+{
+public:
+    struct Result
+    {
+        double cachedMs { 0.0 };
+        double uncachedMs { 0.0 };
+        double scopeOnlyMs { 0.0 };
+    };
+    
+    static Result run(int numPaints = 500);
+    static juce::String formatResult(const Result& result, int numPaints);
+};
@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+  
+    Main.cpp
+    Created: 19 Oct 2026 9:20:13am
+    Author:  Giuseppe Rivezzi
+  
+  ==============================================================================
+*/
+#include <JuceHeader.h>
+#include <iostream>
+#include "EditorPaintBenchmark.h"
+#include "MultiInstanceBenchmark.h"
+
+// Runs the IChorus unit tests, then the multi-instance and editor paint benchmarks.
+//
+//   --tests-only              skip the benchmark
+//   --benchmark-only          skip the unit tests
+//   --instances=1,8,64,200    instance counts to benchmark
+//   --cycles=500              graph cycles per instance count
+//   --compact                 use 16-bit delay storage in every instance
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    juce::ArgumentList args (argc, argv);
+    int numFailures = 0;
+    
+    // --- Unit Tests ---
+    if (! args.containsOption("--benchmark-only"))
+    {
+        juce::UnitTestRunner runner;
+        runner.setAssertOnFailure(false);
+        runner.runTestsInCategory("IChorus");
+        
+        for (int i = 0; i < runner.getNumResults(); ++i)
+            numFailures += runner.getResult(i)->failures;
+    }
+    
+    // --- Benchmark ---
+    if (! args.containsOption("--tests-only"))
+    {
+        MultiInstanceBenchmark::Settings settings;
+        settings.compactDelayStorage = args.containsOption("--compact");
+        
+        if (args.containsOption("--cycles"))
+            settings.numCycles = juce::jmax(1, args.getValueForOption("--cycles").getIntValue());
+        
+        if (args.containsOption("--instances"))
+        {
+            settings.instanceCounts.clear();
+            
+            for (auto& count : juce::StringArray::fromTokens(args.getValueForOption("--instances"), ",", {}))
+                if (count.getIntValue() > 0)
+                    settings.instanceCounts.push_back(count.getIntValue());
+        }
+        
+        MultiInstanceBenchmark benchmark (settings);
+        std::cout << MultiInstanceBenchmark::formatResults(benchmark.run(), settings) << std::endl;
+        
+        const int numPaints = 500;
+        std::cout << EditorPaintBenchmark::formatResult(EditorPaintBenchmark::run(numPaints), numPaints) << std::flush;
+    }
+    
+    return numFailures > 0 ? 1 : 0;
+}
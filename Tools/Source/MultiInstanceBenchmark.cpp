@@ -0,0 +1,411 @@
+/*
+  ==============================================================================
+  
+    MultiInstanceBenchmark.cpp
+    Created: 18 Oct 2026 2:05:37pm
+    Author:  Giuseppe Rivezzi
+  
+  ==============================================================================
+*/
+#include "MultiInstanceBenchmark.h"
+#include "../../Source/PluginProcessor.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+#if JUCE_LINUX
+ #include <linux/perf_event.h>
+ #include <sys/ioctl.h>
+ #include <sys/syscall.h>
+ #include <unistd.h>
+#elif JUCE_MAC
+ #include <mach/mach.h>
+#endif
+
+namespace
+{
+    double ticksToMs(juce::int64 ticks)
+    {
+        return juce::Time::highResolutionTicksToSeconds(ticks) * 1000.0;
+    }
+    
+    double percentile(std::vector<double> values, double fraction)
+    {
+        if (values.empty())
+            return 0.0;
+        
+        auto index = static_cast<size_t>(fraction * static_cast<double>(values.size() - 1));
+        std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+        return values[index];
+    }
+    
+    juce::int64 getResidentMemoryBytes()
+    {
+       #if JUCE_LINUX
+        // The second field of /proc/self/statm is the resident page count.
+        auto fields = juce::StringArray::fromTokens(juce::File("/proc/self/statm").loadFileAsString(), true);
+        
+        if (fields.size() > 1)
+            return fields[1].getLargeIntValue() * static_cast<juce::int64>(sysconf(_SC_PAGESIZE));
+        
+        return -1;
+       #elif JUCE_MAC
+        mach_task_basic_info info;
+        mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+        
+        if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS)
+            return static_cast<juce::int64>(info.resident_size);
+        
+        return -1;
+       #else
+        return -1;
+       #endif
+    }
+    
+    // Hardware cache counters for the calling thread. Reads return -1 when
+    // perf_event_open is missing or not permitted.
+    class CacheCounters
+    {
+    public:
+        CacheCounters()
+        {
+           #if JUCE_LINUX
+            missesFd = openCounter(PERF_COUNT_HW_CACHE_MISSES);
+            referencesFd = openCounter(PERF_COUNT_HW_CACHE_REFERENCES);
+           #endif
+        }
+        
+        ~CacheCounters()
+        {
+           #if JUCE_LINUX
+            if (missesFd >= 0)
+                close(missesFd);
+            if (referencesFd >= 0)
+                close(referencesFd);
+           #endif
+        }
+        
+        void start()
+        {
+           #if JUCE_LINUX
+            if (missesFd >= 0)
+                ioctl(missesFd, PERF_EVENT_IOC_ENABLE, 0);
+            if (referencesFd >= 0)
+                ioctl(referencesFd, PERF_EVENT_IOC_ENABLE, 0);
+           #endif
+        }
+        
+        void stop()
+        {
+           #if JUCE_LINUX
+            if (missesFd >= 0)
+                ioctl(missesFd, PERF_EVENT_IOC_DISABLE, 0);
+            if (referencesFd >= 0)
+                ioctl(referencesFd, PERF_EVENT_IOC_DISABLE, 0);
+           #endif
+        }
+        
+        juce::int64 getMisses() const { return readCounter(missesFd); }
+        juce::int64 getReferences() const { return readCounter(referencesFd); }
+        
+    private:
+       #if JUCE_LINUX
+        static int openCounter(juce::uint64 config)
+        {
+            perf_event_attr attr {};
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = config;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            
+            // pid 0, cpu -1: this thread, on whichever core it runs.
+            return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+       #endif
+        
+        static juce::int64 readCounter(int fd)
+        {
+           #if JUCE_LINUX
+            juce::uint64 value = 0;
+            
+            if (fd >= 0 && read(fd, &value, sizeof(value)) == static_cast<ssize_t>(sizeof(value)))
+                return static_cast<juce::int64>(value);
+           #else
+            juce::ignoreUnused(fd);
+           #endif
+            return -1;
+        }
+        
+        int missesFd { -1 };
+        int referencesFd { -1 };
+    };
+    
+    struct Instance
+    {
+        std::unique_ptr<IChorusAudioProcessor> processor;
+        juce::AudioBuffer<float> buffer;
+        juce::MidiBuffer midi;
+    };
+}
+
+MultiInstanceBenchmark::MultiInstanceBenchmark(Settings settingsToUse)
+    : settings(std::move(settingsToUse))
+{
+}
+
+std::vector<MultiInstanceBenchmark::Result> MultiInstanceBenchmark::run()
+{
+    std::vector<Result> results;
+    
+    for (int numInstances : settings.instanceCounts)
+        results.push_back(runWithInstances(numInstances));
+    
+    return results;
+}
+
+MultiInstanceBenchmark::Result MultiInstanceBenchmark::runWithInstances(int numInstances)
+{
+    Result result;
+    result.numInstances = numInstances;
+    
+    if (numInstances <= 0)
+        return result;
+    
+    const int blockSize = settings.blockSize;
+    const int numThreads = juce::jmax(1, settings.numThreads);
+    juce::Random random (numInstances);
+    
+    // --- Session Setup ---
+    const auto memoryBefore = getResidentMemoryBytes();
+    
+    std::vector<Instance> instances (static_cast<size_t>(numInstances));
+    
+    for (auto& instance : instances)
+    {
+        instance.processor = std::make_unique<IChorusAudioProcessor>();
+        
+        // Spread the parameters so instances do not all run identical settings.
+        for (auto* param : instance.processor->getParameters())
+            param->setValueNotifyingHost(random.nextFloat());
+        
+        instance.processor->setCompactDelayStorage(settings.compactDelayStorage);
+        instance.processor->setRateAndBufferSizeDetails(settings.sampleRate, blockSize);
+        instance.processor->prepareToPlay(settings.sampleRate, blockSize);
+        instance.buffer.setSize(instance.processor->getTotalNumOutputChannels(), blockSize);
+        instance.midi.ensureSize(256);
+    }
+    
+    const auto memoryAfter = getResidentMemoryBytes();
+    if (memoryBefore >= 0 && memoryAfter >= 0)
+        result.memoryBytes = memoryAfter - memoryBefore;
+    
+    // --- State Save / Load ---
+    {
+        std::vector<juce::MemoryBlock> binaryStates (instances.size());
+        std::vector<juce::MemoryBlock> xmlStates (instances.size());
+        const double perInstanceUs = 1.0e3 / static_cast<double>(numInstances);
+        
+        auto start = juce::Time::getHighResolutionTicks();
+        for (size_t i = 0; i < instances.size(); ++i)
+            instances[i].processor->getStateInformation(binaryStates[i]);
+        result.binarySaveUs = ticksToMs(juce::Time::getHighResolutionTicks() - start) * perInstanceUs;
+        
+        start = juce::Time::getHighResolutionTicks();
+        for (size_t i = 0; i < instances.size(); ++i)
+            instances[i].processor->setStateInformation(binaryStates[i].getData(), static_cast<int>(binaryStates[i].getSize()));
+        result.binaryLoadUs = ticksToMs(juce::Time::getHighResolutionTicks() - start) * perInstanceUs;
+        
+        // The legacy format, as written before the binary layout existed.
+        start = juce::Time::getHighResolutionTicks();
+        for (size_t i = 0; i < instances.size(); ++i)
+        {
+            auto state = instances[i].processor->getAPVTS().copyState();
+            std::unique_ptr<juce::XmlElement> xml (state.createXml());
+            juce::AudioProcessor::copyXmlToBinary(*xml, xmlStates[i]);
+        }
+        result.xmlSaveUs = ticksToMs(juce::Time::getHighResolutionTicks() - start) * perInstanceUs;
+        
+        start = juce::Time::getHighResolutionTicks();
+        for (size_t i = 0; i < instances.size(); ++i)
+            instances[i].processor->setStateInformation(xmlStates[i].getData(), static_cast<int>(xmlStates[i].getSize()));
+        result.xmlLoadUs = ticksToMs(juce::Time::getHighResolutionTicks() - start) * perInstanceUs;
+    }
+    
+    // --- Input Signal ---
+    juce::AudioBuffer<float> source (instances.front().buffer.getNumChannels(), blockSize);
+    for (int ch = 0; ch < source.getNumChannels(); ++ch)
+        for (int sample = 0; sample < blockSize; ++sample)
+            source.setSample(ch, sample, (random.nextFloat() * 2.0f - 1.0f) * 0.25f);
+    
+    // --- Worker Pool ---
+    // Each graph cycle, every worker pulls instances off a shared counter
+    // until all have been processed, then the next cycle starts.
+    const int totalCycles = settings.numWarmupCycles + settings.numCycles;
+    std::vector<juce::int64> blockTicks (static_cast<size_t>(settings.numCycles) * instances.size());
+    std::vector<juce::int64> cycleTicks (static_cast<size_t>(settings.numCycles));
+    std::vector<juce::int64> threadMisses (static_cast<size_t>(numThreads), -1);
+    std::vector<juce::int64> threadReferences (static_cast<size_t>(numThreads), -1);
+    
+    std::mutex mutex;
+    std::condition_variable cycleStarted, cycleFinished;
+    std::atomic<int> nextInstance { 0 };
+    std::atomic<int> pendingWorkers { 0 };
+    int generation = 0;
+    int recordSlot = -1;   // -1 while warming up.
+    bool finished = false;
+    
+    auto worker = [&](int threadIndex)
+    {
+        CacheCounters counters;
+        int seenGeneration = 0;
+        
+        for (;;)
+        {
+            int slot = -1;
+            {
+                std::unique_lock<std::mutex> lock (mutex);
+                cycleStarted.wait(lock, [&] { return finished || generation != seenGeneration; });
+                
+                if (finished)
+                    break;
+                
+                seenGeneration = generation;
+                slot = recordSlot;
+            }
+            
+            if (slot >= 0)
+                counters.start();
+            
+            for (int i = nextInstance.fetch_add(1); i < numInstances; i = nextInstance.fetch_add(1))
+            {
+                auto& instance = instances[static_cast<size_t>(i)];
+                
+                const auto start = juce::Time::getHighResolutionTicks();
+                instance.processor->processBlock(instance.buffer, instance.midi);
+                const auto elapsed = juce::Time::getHighResolutionTicks() - start;
+                
+                if (slot >= 0)
+                    blockTicks[static_cast<size_t>(slot) * instances.size() + static_cast<size_t>(i)] = elapsed;
+            }
+            
+            if (slot >= 0)
+                counters.stop();
+            
+            if (pendingWorkers.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> lock (mutex);
+                cycleFinished.notify_one();
+            }
+        }
+        
+        threadMisses[static_cast<size_t>(threadIndex)] = counters.getMisses();
+        threadReferences[static_cast<size_t>(threadIndex)] = counters.getReferences();
+    };
+    
+    std::vector<std::thread> workers;
+    for (int t = 0; t < numThreads; ++t)
+        workers.emplace_back(worker, t);
+    
+    for (int cycle = 0; cycle < totalCycles; ++cycle)
+    {
+        // Fresh input for every instance, outside the timed region.
+        for (auto& instance : instances)
+            instance.buffer.makeCopyOf(source, true);
+        
+        const int slot = cycle - settings.numWarmupCycles;
+        const auto start = juce::Time::getHighResolutionTicks();
+        
+        {
+            std::lock_guard<std::mutex> lock (mutex);
+            nextInstance = 0;
+            pendingWorkers = numThreads;
+            recordSlot = slot;
+            ++generation;
+        }
+        cycleStarted.notify_all();
+        
+        {
+            std::unique_lock<std::mutex> lock (mutex);
+            cycleFinished.wait(lock, [&] { return pendingWorkers.load() == 0; });
+        }
+        
+        if (slot >= 0)
+            cycleTicks[static_cast<size_t>(slot)] = juce::Time::getHighResolutionTicks() - start;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock (mutex);
+        finished = true;
+    }
+    cycleStarted.notify_all();
+    
+    for (auto& thread : workers)
+        thread.join();
+    
+    // --- Statistics ---
+    std::vector<double> blockMs (blockTicks.size());
+    std::transform(blockTicks.begin(), blockTicks.end(), blockMs.begin(), ticksToMs);
+    std::vector<double> cycleMs (cycleTicks.size());
+    std::transform(cycleTicks.begin(), cycleTicks.end(), cycleMs.begin(), ticksToMs);
+    
+    result.blockP50Ms = percentile(blockMs, 0.50);
+    result.blockP99Ms = percentile(blockMs, 0.99);
+    result.blockMaxMs = blockMs.empty() ? 0.0 : *std::max_element(blockMs.begin(), blockMs.end());
+    result.cycleP99Ms = percentile(cycleMs, 0.99);
+    
+    if (std::none_of(threadMisses.begin(), threadMisses.end(), [](auto v) { return v < 0; }))
+        result.cacheMisses = std::accumulate(threadMisses.begin(), threadMisses.end(), juce::int64 { 0 });
+    if (std::none_of(threadReferences.begin(), threadReferences.end(), [](auto v) { return v < 0; }))
+        result.cacheReferences = std::accumulate(threadReferences.begin(), threadReferences.end(), juce::int64 { 0 });
+    
+    return result;
+}
+
+juce::String MultiInstanceBenchmark::formatResults(const std::vector<Result>& results, const Settings& settings)
+{
+    const double blockBudgetMs = 1000.0 * settings.blockSize / settings.sampleRate;
+    
+    juce::String text;
+    text << "IChorus multi-instance benchmark: " << settings.sampleRate << " Hz, "
+         << settings.blockSize << " samples (" << juce::String(blockBudgetMs, 2) << " ms budget), "
+         << settings.numThreads << " workers, " << settings.numCycles << " cycles, "
+         << (settings.compactDelayStorage ? "16-bit" : "float") << " delay storage" << juce::newLine;
+    
+    // Right-aligned fixed-width columns.
+    auto column = [](const juce::String& value, int width) { return value.paddedLeft(' ', width) + " "; };
+    auto counterText = [](juce::int64 value) { return value < 0 ? juce::String("n/a") : juce::String(value); };
+    
+    text << column("instances", 9) << column("p50 ms", 9) << column("p99 ms", 9) << column("max ms", 9)
+         << column("cycle p99", 10) << column("memory MB", 10) << column("cache miss", 12) << column("cache ref", 12)
+         << column("bin save", 9) << column("bin load", 9) << column("xml save", 9) << column("xml load", 9)
+         << juce::newLine;
+    
+    for (const auto& r : results)
+    {
+        const auto memoryText = r.memoryBytes < 0 ? juce::String("n/a")
+                                                  : juce::String(static_cast<double>(r.memoryBytes) / (1024.0 * 1024.0), 1);
+        
+        text << column(juce::String(r.numInstances), 9)
+             << column(juce::String(r.blockP50Ms, 3), 9)
+             << column(juce::String(r.blockP99Ms, 3), 9)
+             << column(juce::String(r.blockMaxMs, 3), 9)
+             << column(juce::String(r.cycleP99Ms, 3), 10)
+             << column(memoryText, 10)
+             << column(counterText(r.cacheMisses), 12)
+             << column(counterText(r.cacheReferences), 12)
+             << column(juce::String(r.binarySaveUs, 2), 9)
+             << column(juce::String(r.binaryLoadUs, 2), 9)
+             << column(juce::String(r.xmlSaveUs, 2), 9)
+             << column(juce::String(r.xmlLoadUs, 2), 9)
+             << juce::newLine;
+    }
+    
+    text << "State timings are microseconds per instance." << juce::newLine;
+    return text;
+}
+
@@ -0,0 +1,76 @@
+/*
+  ==============================================================================
+  
+    MultiInstanceBenchmark.h
+    Created: 18 Oct 2026 2:05:37pm
+    Author:  Giuseppe Rivezzi
+  
+  ==============================================================================
+*/
+#pragma once
+
+#include <JuceHeader.h>
+#include <vector>
+
+// Simulates a busy DAW session: N IChorusAudioProcessor instances prepared at
+// realistic settings and processed once per graph cycle by a pool of worker
+// threads, the way a host spreads independent plugins across its audio workers.
+//
+// Needs a running message manager (e.g. juce::ScopedJuceInitialiser_GUI),
+// since each instance owns an APVTS.
+class MultiInstanceBenchmark
+{
+public:
+    struct Settings
+    {
+        double sampleRate { 48000.0 };
+        int blockSize { 256 };
+        int numWarmupCycles { 20 };
+        int numCycles { 500 };
+        int numThreads { juce::SystemStats::getNumCpus() };
+        bool compactDelayStorage { false };
+        std::vector<int> instanceCounts { 1, 8, 32, 100, 200, 400 };
+    };
+    
+    struct Result
+    {
+        int numInstances { 0 };
+        
+        // Single processBlock call, in milliseconds.
+        double blockP50Ms { 0.0 };
+        double blockP99Ms { 0.0 };
+        double blockMaxMs { 0.0 };
+        
+        // Whole graph cycle (all instances), in milliseconds.
+        double cycleP99Ms { 0.0 };
+        
+        // Resident memory added by creating and preparing the instances.
+        juce::int64 memoryBytes { -1 };
+        
+        // Hardware counters summed over all workers, -1 when unavailable.
+        juce::int64 cacheMisses { -1 };
+        juce::int64 cacheReferences { -1 };
+        
+        // Per-instance state save/load, in microseconds.
+        double binarySaveUs { 0.0 };
+        double binaryLoadUs { 0.0 };
+        double xmlSaveUs { 0.0 };
+        double xmlLoadUs { 0.0 };
+    };
+    
+    explicit MultiInstanceBenchmark(Settings settingsToUse = {});
+    
+    // Runs every configured instance count in turn.
+    std::vector<Result> run();
+    
+    // Runs a single instance count.
+    Result runWithInstances(int numInstances);
+    
+    // Formats results as a plain-text table, one row per instance count.
+    static juce::String formatResults(const std::vector<Result>& results, const Settings& settings);
+    
+    const Settings& getSettings() const { return settings; }
+    
+private:
+    Settings settings;
+};
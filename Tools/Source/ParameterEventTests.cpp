@@ -0,0 +1,153 @@
+/*
+  ==============================================================================
+  
+    ParameterEventTests.cpp
+    Created: 19 Oct 2026 5:08:26pm
+    Author:  Giuseppe Rivezzi
+  
+  ==============================================================================
+*/
+#include <JuceHeader.h>
+#include <utility>
+#include <vector>
+#include "../../Source/PluginProcessor.h"
+
+class ParameterEventTests : public juce::UnitTest
+{
+public:
+    ParameterEventTests() : juce::UnitTest("Parameter events", "IChorus") {}
+    
+    void runTest() override
+    {
+        beginTest("Blocks are split at sorted, clamped change points");
+        {
+            // Out of order, two at the same offset, one before and one past the block.
+            std::vector<ParameterEvent> events {
+                { 0, 100, 0.4f },
+                { 0,  30, 0.2f },
+                { 1,  30, 0.3f },
+                { 0, 600, 0.5f },
+                { 1,  -5, 0.1f },
+            };
+            
+            std::vector<std::pair<int, int>> ranges;
+            std::vector<float> applied;
+            
+            processWithParameterEvents(events.data(), static_cast<int>(events.size()), 512,
+                [&ranges](int start, int num) { ranges.emplace_back(start, num); },
+                [&applied](const ParameterEvent& e) { applied.push_back(e.value); });
+            
+            const std::vector<std::pair<int, int>> expectedRanges { { 0, 30 }, { 30, 70 }, { 100, 412 } };
+            const std::vector<float> expectedApplied { 0.1f, 0.2f, 0.3f, 0.4f, 0.5f };
+            
+            expect(ranges == expectedRanges, "sub-block boundaries");
+            expect(applied == expectedApplied, "events applied in sample order, ties in arrival order");
+        }
+        
+        beginTest("A block without events is processed whole");
+        {
+            std::vector<std::pair<int, int>> ranges;
+            processWithParameterEvents(nullptr, 0, 256,
+                [&ranges](int start, int num) { ranges.emplace_back(start, num); },
+                [](const ParameterEvent&) {});
+            
+            expect(ranges == std::vector<std::pair<int, int>> { { 0, 256 } });
+        }
+        
+        beginTest("Audio changes at the event offset, not before");
+        {
+            const int blockSize = 512;
+            const int eventOffset = 200;
+            
+            IChorusAudioProcessor reference, automated;
+            juce::AudioBuffer<float> referenceBuffer, automatedBuffer;
+            juce::MidiBuffer midi;
+            
+            for (auto* processor : { &reference, &automated })
+                processor->prepareToPlay(48000.0, blockSize);
+            
+            // A few identical blocks first, so the delay line holds signal.
+            for (int i = 0; i < 8; ++i)
+            {
+                fillWithSine(referenceBuffer, reference.getTotalNumOutputChannels(), blockSize, i);
+                fillWithSine(automatedBuffer, automated.getTotalNumOutputChannels(), blockSize, i);
+                reference.processBlock(referenceBuffer, midi);
+                automated.processBlock(automatedBuffer, midi);
+            }
+            
+            // Like a wrapper: the parameter holds the end-of-block value and
+            // the event says where in the block it takes over.
+            auto* mix = automated.getAPVTS().getParameter("mix");
+            const float mixBefore = mix->getValue();
+            mix->setValueNotifyingHost(0.0f);
+            expect(automated.queueParameterEvent(mix->getParameterIndex(), eventOffset, 0.0f));
+            
+            fillWithSine(referenceBuffer, reference.getTotalNumOutputChannels(), blockSize, 8);
+            fillWithSine(automatedBuffer, automated.getTotalNumOutputChannels(), blockSize, 8);
+            reference.processBlock(referenceBuffer, midi);
+            automated.processBlock(automatedBuffer, midi);
+            
+            // Channel 0 only: ChorusProcessor advances one LFO phase across
+            // channels in turn, so later channels depend on where the block was split.
+            const float* expected = referenceBuffer.getReadPointer(0);
+            const float* actual = automatedBuffer.getReadPointer(0);
+            
+            float maxDifferenceBefore = 0.0f, maxDifferenceAfter = 0.0f;
+            for (int i = 0; i < eventOffset; ++i)
+                maxDifferenceBefore = juce::jmax(maxDifferenceBefore, std::abs(actual[i] - expected[i]));
+            for (int i = eventOffset; i < blockSize; ++i)
+                maxDifferenceAfter = juce::jmax(maxDifferenceAfter, std::abs(actual[i] - expected[i]));
+            
+            expectLessThan(maxDifferenceBefore, 1.0e-6f);
+            expectGreaterThan(maxDifferenceAfter, 1.0e-3f);
+            
+            // processBlock leaves the parameters alone; the end value came from the caller.
+            expectWithinAbsoluteError(mix->getValue(), 0.0f, 1.0e-5f);
+            expectWithinAbsoluteError(reference.getAPVTS().getParameter("mix")->getValue(), mixBefore, 1.0e-5f);
+        }
+        
+        beginTest("Events do not write parameters and are consumed by the block");
+        {
+            IChorusAudioProcessor processor;
+            processor.prepareToPlay(48000.0, 512);
+            
+            auto& apvts = processor.getAPVTS();
+            auto* rate = apvts.getParameter("rate");
+            auto* mix = apvts.getParameter("mix");
+            const float rateBefore = rate->getValue();
+            const float mixBefore = mix->getValue();
+            
+            juce::AudioBuffer<float> buffer (processor.getTotalNumOutputChannels(), 512);
+            juce::MidiBuffer midi;
+            
+            expect(processor.queueParameterEvent(mix->getParameterIndex(), 300, 0.9f));
+            expect(processor.queueParameterEvent(rate->getParameterIndex(), 50, 0.7f));
+            expect(processor.queueParameterEvent(-1, 10, 1.0f)); // unknown index, ignored
+            
+            buffer.clear();
+            processor.processBlock(buffer, midi);
+            
+            expectWithinAbsoluteError(rate->getValue(), rateBefore, 1.0e-5f);
+            expectWithinAbsoluteError(mix->getValue(), mixBefore, 1.0e-5f);
+            
+            // The queue is empty again: the full capacity is available.
+            for (int i = 0; i < ParameterEventQueue::capacity; ++i)
+                expect(processor.queueParameterEvent(mix->getParameterIndex(), 0, 0.5f));
+            expect(! processor.queueParameterEvent(mix->getParameterIndex(), 0, 0.5f));
+        }
+    }
+    
+private:
+    // 440 Hz sine at -6 dBFS, continuing from block blockIndex.
+    static void fillWithSine(juce::AudioBuffer<float>& buffer, int numChannels, int numSamples, int blockIndex)
+    {
+        buffer.setSize(numChannels, numSamples, false, false, true);
+        
+        for (int ch = 0; ch < numChannels; ++ch)
+            for (int i = 0; i < numSamples; ++i)
+                buffer.setSample(ch, i, 0.5f * std::sin(juce::MathConstants<float>::twoPi * 440.0f
+                                                          * static_cast<float>(blockIndex * numSamples + i) / 48000.0f));
+    }
+};
+
+static ParameterEventTests parameterEventTests;
@@ -0,0 +1,133 @@
+/*
+  ==============================================================================
+  
+    StateFormatTests.cpp
+    Created: 19 Oct 2026 1:47:30pm
+    Author:  Giuseppe Rivezzi
+  
+  ==============================================================================
+*/
+#include <JuceHeader.h>
+#include "../../Source/PluginProcessor.h"
+
+class StateFormatTests : public juce::UnitTest
+{
+public:
+    StateFormatTests() : juce::UnitTest("State format", "IChorus") {}
+    
+    void runTest() override
+    {
+        beginTest("Binary state round-trips");
+        {
+            IChorusAudioProcessor source, destination;
+            setValues(source, 0.25f);
+            
+            juce::MemoryBlock state;
+            source.getStateInformation(state);
+            destination.setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+            
+            expectValuesMatch(source, destination);
+        }
+        
+        beginTest("Legacy XML state loads and re-saves as binary");
+        {
+            IChorusAudioProcessor source, destination, reloaded;
+            setValues(source, 0.7f);
+            
+            juce::MemoryBlock legacyState;
+            std::unique_ptr<juce::XmlElement> xml (source.getAPVTS().copyState().createXml());
+            juce::AudioProcessor::copyXmlToBinary(*xml, legacyState);
+            
+            destination.setStateInformation(legacyState.getData(), static_cast<int>(legacyState.getSize()));
+            expectValuesMatch(source, destination);
+            
+            juce::MemoryBlock binaryState;
+            destination.getStateInformation(binaryState);
+            expect(binaryState.getSize() >= 4);
+            expectEquals(static_cast<int>(juce::ByteOrder::littleEndianInt(binaryState.getData())), 0x53484349);
+            
+            reloaded.setStateInformation(binaryState.getData(), static_cast<int>(binaryState.getSize()));
+            expectValuesMatch(source, reloaded);
+        }
+        
+        beginTest("Truncated binary state is rejected");
+        {
+            IChorusAudioProcessor source, destination, untouched;
+            setValues(source, 0.9f);
+            setValues(destination, 0.1f);
+            setValues(untouched, 0.1f);
+            
+            juce::MemoryBlock state;
+            source.getStateInformation(state);
+            destination.setStateInformation(state.getData(), static_cast<int>(state.getSize()) - 3);
+            
+            expectValuesMatch(untouched, destination);
+        }
+        
+        beginTest("Values are matched by parameter ID, not position");
+        {
+            IChorusAudioProcessor destination;
+            setValues(destination, 0.1f);
+            
+            // Reordered blob with one ID the plugin no longer has.
+            juce::MemoryBlock state;
+            {
+                juce::MemoryOutputStream stream (state, false);
+                stream.writeInt(0x53484349);
+                stream.writeShort(1);
+                stream.writeShort(2);
+                stream.writeInt(static_cast<int>(hashParameterID("removed")));
+                stream.writeFloat(0.3f);
+                stream.writeInt(static_cast<int>(hashParameterID("mix")));
+                stream.writeFloat(0.8f);
+            }
+            destination.setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+            
+            auto& apvts = destination.getAPVTS();
+            expectWithinAbsoluteError(apvts.getParameter("mix")->getValue(), 0.8f, 1.0e-5f);
+            
+            // Parameters missing from the blob fall back to their defaults.
+            for (auto id : { "rate", "depth" })
+            {
+                auto* param = apvts.getParameter(id);
+                expectWithinAbsoluteError(param->getValue(), param->getDefaultValue(), 1.0e-5f);
+            }
+        }
+    }
+    
+private:
+    // Mirrors the FNV-1a ID hash written by getStateInformation.
+    static juce::uint32 hashParameterID(const juce::String& parameterID)
+    {
+        juce::uint32 hash = 2166136261u;
+        
+        for (auto* c = parameterID.toRawUTF8(); *c != 0; ++c)
+        {
+            hash ^= static_cast<juce::uint8>(*c);
+            hash *= 16777619u;
+        }
+        
+        return hash;
+    }
+    
+    // Gives every parameter a distinct value derived from base.
+    static void setValues(IChorusAudioProcessor& processor, float base)
+    {
+        const auto& params = processor.getParameters();
+        
+        for (int i = 0; i < params.size(); ++i)
+            params[i]->setValueNotifyingHost(std::fmod(base + 0.13f * static_cast<float>(i), 1.0f));
+    }
+    
+    void expectValuesMatch(IChorusAudioProcessor& expected, IChorusAudioProcessor& actual)
+    {
+        const auto& expectedParams = expected.getParameters();
+        const auto& actualParams = actual.getParameters();
+        expectEquals(actualParams.size(), expectedParams.size());
+        
+        for (int i = 0; i < juce::jmin(expectedParams.size(), actualParams.size()); ++i)
+            expectWithinAbsoluteError(actualParams[i]->getValue(), expectedParams[i]->getValue(), 1.0e-5f);
+    }
+};
+
+static StateFormatTests stateFormatTests;